@@ -1,5 +1,5 @@
 // Calculus Calculator - C++ Implementation
-// Demonstrates derivatives, integrals, and limits
+// Demonstrates derivatives, integrals, limits, Chebyshev proxies, and extrapolation
 
 #include <iostream>
 #include <cmath>
@@ -7,11 +7,593 @@
 #include <vector>
 #include <iomanip>
 #include <string>
+#include <complex>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+// Chebyshev proxy of a smooth function on [a, b]
+// f(x) ≈ Σ c_k T_k(t), where t = (2x - a - b) / (b - a) maps [a, b] onto [-1, 1]
+// f is sampled once at Chebyshev points; every query afterwards works on the
+// coefficients only and never calls f again.
+class ChebyshevProxy {
+private:
+    double a, b;
+    std::vector<double> coeffs;
+    std::vector<double> derivCoeffs;    // f' on [a, b], computed once
+    bool resolved;
+
+    // Largest degree handed to the colleague matrix before subdividing
+    static constexpr size_t maxColleagueDegree = 50;
+
+    // Subdivision levels allowed before root finding gives up; a resolved
+    // proxy of degree n needs about log2(n / maxColleagueDegree) of them
+    static constexpr int maxSplitDepth = 16;
+
+    // Eigenvalues with |Im λ| below this (relative to |λ|) are treated as
+    // candidate real roots and confirmed by Newton's method
+    static constexpr double nearRealTol = 1e-4;
+
+    double toUnit(double x) const { return (2.0 * x - a - b) / (b - a); }
+    double fromUnit(double t) const { return 0.5 * (b - a) * t + 0.5 * (a + b); }
+
+    // The expansion is only valid on [a, b]; outside it the series diverges
+    void checkInside(double x) const {
+        if (!(x >= a && x <= b)) {
+            throw std::invalid_argument("Point must lie within the proxy interval");
+        }
+    }
+
+    // Evaluate Σ c_k T_k(t) using Clenshaw's recurrence
+    static double clenshaw(const std::vector<double>& c, double t) {
+        double b1 = 0.0, b2 = 0.0;
+        for (size_t k = c.size() - 1; k >= 1; k--) {
+            double b0 = 2.0 * t * b1 - b2 + c[k];
+            b2 = b1;
+            b1 = b0;
+        }
+        return c[0] + t * b1 - b2;
+    }
+
+    // In-place iterative radix-2 FFT (size must be a power of two)
+    static void fft(std::vector<std::complex<double>>& v) {
+        size_t n = v.size();
+        for (size_t i = 1, j = 0; i < n; i++) {
+            size_t bit = n >> 1;
+            for (; j & bit; bit >>= 1) j ^= bit;
+            j ^= bit;
+            if (i < j) std::swap(v[i], v[j]);
+        }
+        for (size_t len = 2; len <= n; len <<= 1) {
+            double angle = -2.0 * M_PI / len;
+            std::complex<double> wlen(std::cos(angle), std::sin(angle));
+            for (size_t i = 0; i < n; i += len) {
+                std::complex<double> w(1.0, 0.0);
+                for (size_t k = 0; k < len / 2; k++) {
+                    std::complex<double> u = v[i + k];
+                    std::complex<double> t = v[i + k + len / 2] * w;
+                    v[i + k] = u + t;
+                    v[i + k + len / 2] = u - t;
+                    w *= wlen;
+                }
+            }
+        }
+    }
+
+    // Chebyshev coefficients from values at the n + 1 points t_j = cos(jπ/n)
+    // The DCT-I is computed as an FFT of the even extension of length 2n
+    static std::vector<double> coefficientsFromValues(const std::vector<double>& values) {
+        size_t n = values.size() - 1;
+        if (n == 0) return {values[0]};
+
+        std::vector<std::complex<double>> ext(2 * n);
+        for (size_t j = 0; j <= n; j++) ext[j] = values[j];
+        for (size_t j = 1; j < n; j++) ext[2 * n - j] = values[j];
+        fft(ext);
+
+        std::vector<double> c(n + 1);
+        for (size_t k = 0; k <= n; k++) c[k] = ext[k].real() / n;
+        c[0] *= 0.5;
+        c[n] *= 0.5;
+        return c;
+    }
+
+    // Eigenvalues of an upper Hessenberg matrix by shifted QR iteration
+    // Diagonal similarity D⁻¹HD (powers of two, so exact) that evens out row
+    // and column norms; the colleague matrix's dense last column otherwise
+    // costs the QR iteration several digits (Parlett & Reinsch)
+    static void balance(std::vector<std::vector<std::complex<double>>>& H) {
+        const double radix = 2.0;
+        size_t n = H.size();
+        bool done = false;
+        while (!done) {
+            done = true;
+            for (size_t i = 0; i < n; i++) {
+                double colNorm = 0.0, rowNorm = 0.0;
+                for (size_t j = 0; j < n; j++) {
+                    if (j == i) continue;
+                    colNorm += std::abs(H[j][i]);
+                    rowNorm += std::abs(H[i][j]);
+                }
+                if (colNorm == 0.0 || rowNorm == 0.0) continue;
+
+                double total = colNorm + rowNorm;
+                double f = 1.0;
+                while (colNorm < rowNorm / radix) {
+                    f *= radix;
+                    colNorm *= radix * radix;
+                }
+                while (colNorm > rowNorm * radix) {
+                    f /= radix;
+                    colNorm /= radix * radix;
+                }
+                if ((colNorm + rowNorm) / f < 0.95 * total) {
+                    done = false;
+                    for (size_t j = 0; j < n; j++) H[i][j] /= f;
+                    for (size_t j = 0; j < n; j++) H[j][i] *= f;
+                }
+            }
+        }
+    }
+
+    static std::vector<std::complex<double>>
+    hessenbergEigenvalues(std::vector<std::vector<std::complex<double>>> H) {
+        const double eps = std::numeric_limits<double>::epsilon();
+        std::vector<std::complex<double>> eigenvalues;
+        int hi = static_cast<int>(H.size()) - 1;
+        int iterations = 0;
+
+        while (hi >= 0) {
+            // Look for a negligible subdiagonal entry to deflate on
+            int lo = hi;
+            while (lo > 0 && std::abs(H[lo][lo - 1]) >
+                   eps * (std::abs(H[lo - 1][lo - 1]) + std::abs(H[lo][lo]))) {
+                lo--;
+            }
+            if (lo == hi) {
+                eigenvalues.push_back(H[hi][hi]);
+                hi--;
+                iterations = 0;
+                continue;
+            }
+            if (++iterations > 60) {
+                throw std::runtime_error("Eigenvalue iteration did not converge");
+            }
+
+            // Wilkinson shift from the trailing 2x2 block, with an
+            // occasional exceptional shift to break cycles
+            std::complex<double> p = H[hi - 1][hi - 1], q = H[hi - 1][hi];
+            std::complex<double> r = H[hi][hi - 1], s = H[hi][hi];
+            std::complex<double> mu;
+            if (iterations % 11 == 10) {
+                mu = s + 0.75 * std::abs(r);
+            } else {
+                std::complex<double> half = 0.5 * (p + s);
+                std::complex<double> disc = std::sqrt(half * half - (p * s - q * r));
+                std::complex<double> mu1 = half + disc, mu2 = half - disc;
+                mu = (std::abs(mu1 - s) < std::abs(mu2 - s)) ? mu1 : mu2;
+            }
+
+            // One QR step H - μI = QR, H ← RQ + μI on the active block
+            for (int k = lo; k <= hi; k++) H[k][k] -= mu;
+            std::vector<std::complex<double>> cs(hi - lo), sn(hi - lo);
+            for (int k = lo; k < hi; k++) {
+                std::complex<double> x = H[k][k], y = H[k + 1][k];
+                double norm = std::hypot(std::abs(x), std::abs(y));
+                std::complex<double> c = (norm == 0.0) ? 1.0 : x / norm;
+                std::complex<double> sv = (norm == 0.0) ? 0.0 : y / norm;
+                cs[k - lo] = c;
+                sn[k - lo] = sv;
+                for (int j = k; j <= hi; j++) {
+                    std::complex<double> u = H[k][j], v = H[k + 1][j];
+                    H[k][j] = std::conj(c) * u + std::conj(sv) * v;
+                    H[k + 1][j] = -sv * u + c * v;
+                }
+            }
+            for (int k = lo; k < hi; k++) {
+                std::complex<double> c = cs[k - lo], sv = sn[k - lo];
+                for (int i = lo; i <= k + 1; i++) {
+                    std::complex<double> u = H[i][k], v = H[i][k + 1];
+                    H[i][k] = u * c + v * sv;
+                    H[i][k + 1] = -u * std::conj(sv) + v * std::conj(c);
+                }
+            }
+            for (int k = lo; k <= hi; k++) H[k][k] += mu;
+        }
+        return eigenvalues;
+    }
+
+    // Real roots in [-1, 1] of Σ c_k T_k(t)
+    // Small degrees use the eigenvalues of the colleague matrix; larger ones
+    // are split in two and re-interpolated (exactly) on each half.
+    static std::vector<double> unitRoots(std::vector<double> c, int depth = 0) {
+        double scale = 0.0;
+        for (double ck : c) scale = std::max(scale, std::abs(ck));
+        if (scale == 0.0) return {};
+        // Re-interpolating a degree-n polynomial leaves rounding noise of
+        // about n·eps in the coefficients; chop it so each subdivision shrinks
+        double chopTol = std::max(1e-14, 10.0 * std::numeric_limits<double>::epsilon() * c.size());
+        while (c.size() > 1 && std::abs(c.back()) <= chopTol * scale) c.pop_back();
+
+        size_t n = c.size() - 1;
+        std::vector<double> roots;
+        if (n == 0) return roots;
+
+        if (n > maxColleagueDegree) {
+            if (depth >= maxSplitDepth) {
+                throw std::runtime_error("Root finding did not converge; subdivision too deep");
+            }
+            // Off-centre split point avoids landing on a root of a symmetric function
+            const double split = -0.004849834917525;
+            size_t m = 1;
+            while (m < n) m <<= 1;
+            const double bounds[2][2] = {{-1.0, split}, {split, 1.0}};
+            for (const auto& bound : bounds) {
+                double lo = bound[0], hi = bound[1];
+                std::vector<double> values(m + 1);
+                for (size_t j = 0; j <= m; j++) {
+                    double s = std::cos(j * M_PI / m);
+                    values[j] = clenshaw(c, 0.5 * (hi - lo) * s + 0.5 * (hi + lo));
+                }
+                for (double s : unitRoots(coefficientsFromValues(values), depth + 1)) {
+                    roots.push_back(0.5 * (hi - lo) * s + 0.5 * (hi + lo));
+                }
+            }
+        } else if (n == 1) {
+            roots.push_back(-c[0] / c[1]);
+        } else {
+            // Transposed colleague matrix is upper Hessenberg
+            std::vector<std::vector<std::complex<double>>> H(
+                n, std::vector<std::complex<double>>(n, 0.0));
+            H[1][0] = 1.0;
+            for (size_t i = 1; i + 1 < n; i++) {
+                H[i - 1][i] = 0.5;
+                H[i + 1][i] = 0.5;
+            }
+            H[n - 2][n - 1] = 0.5;
+            for (size_t j = 0; j < n; j++) H[j][n - 1] -= c[j] / (2.0 * c[n]);
+            balance(H);
+
+            for (const auto& lambda : hessenbergEigenvalues(H)) {
+                if (std::abs(lambda.imag()) <= nearRealTol * std::max(1.0, std::abs(lambda))) {
+                    roots.push_back(lambda.real());
+                }
+            }
+        }
+
+        // Polish candidates with Newton's method and keep those that settle
+        // on a genuine zero inside [-1, 1]
+        const double eps = std::numeric_limits<double>::epsilon();
+        double coeffSum = 0.0;
+        for (double ck : c) coeffSum += std::abs(ck);
+        const double residualTol = 1e3 * eps * coeffSum;
+
+        std::vector<double> deriv = unitDerivative(c);
+        std::vector<double> result;
+        for (double t : roots) {
+            if (std::abs(t) > 1.0 + nearRealTol) continue;
+            t = std::max(-1.0, std::min(1.0, t));
+            bool inside = true;
+            for (int iter = 0; iter < 20; iter++) {
+                double value = clenshaw(c, t);
+                double slope = clenshaw(deriv, t);
+                if (value == 0.0 || slope == 0.0) break;
+                double step = value / slope;
+                t -= step;
+                if (std::abs(t) > 1.0 + 1e-12) {
+                    inside = false;
+                    break;
+                }
+                if (std::abs(step) <= 4.0 * eps * std::max(1.0, std::abs(t))) break;
+            }
+            if (inside && std::abs(clenshaw(c, t)) <= residualTol) {
+                result.push_back(std::max(-1.0, std::min(1.0, t)));
+            }
+        }
+        std::sort(result.begin(), result.end());
+        result.erase(std::unique(result.begin(), result.end(),
+                                 [](double x, double y) { return std::abs(x - y) < 1e-10; }),
+                     result.end());
+        return result;
+    }
+
+    // Coefficients of d/dt Σ c_k T_k(t)
+    static std::vector<double> unitDerivative(const std::vector<double>& c) {
+        size_t n = c.size() - 1;
+        if (n == 0) return {0.0};
+        std::vector<double> d(n + 2, 0.0);
+        for (size_t k = n; k >= 1; k--) {
+            d[k - 1] = d[k + 1] + 2.0 * k * c[k];
+        }
+        d[0] *= 0.5;
+        d.resize(n);
+        return d;
+    }
+
+public:
+    ChebyshevProxy(std::vector<double> c, double a, double b, bool resolved = true)
+        : a(a), b(b), coeffs(std::move(c)), resolved(resolved) {
+        if (coeffs.empty()) coeffs.push_back(0.0);
+        derivCoeffs = unitDerivative(coeffs);
+        for (double& dk : derivCoeffs) dk *= 2.0 / (b - a);
+    }
+
+    // Sample f at 17, 33, 65, ... Chebyshev points until the trailing
+    // coefficients fall to machine precision, then chop the negligible tail.
+    // Point sets are nested, so each doubling only evaluates f at the new points.
+    // If f is not resolved by maxDegree the proxy is returned unresolved.
+    // A non-finite sample (e.g. log(x) at x = 0) cannot be approximated and
+    // throws std::invalid_argument.
+    static ChebyshevProxy build(std::function<double(double)> f, double a, double b,
+                                size_t maxDegree = 4096) {
+        if (!(b > a)) {
+            throw std::invalid_argument("Interval must satisfy a < b");
+        }
+        const double eps = std::numeric_limits<double>::epsilon();
+        auto sample = [&f, a, b](size_t j, size_t n) {
+            double x = 0.5 * (b - a) * std::cos(j * M_PI / n) + 0.5 * (a + b);
+            double value = f(x);
+            if (!std::isfinite(value)) {
+                throw std::invalid_argument("Function is not finite at x = " + std::to_string(x));
+            }
+            return value;
+        };
+
+        size_t n = 16;
+        std::vector<double> values(n + 1);
+        for (size_t j = 0; j <= n; j++) values[j] = sample(j, n);
+
+        while (true) {
+            std::vector<double> c = coefficientsFromValues(values);
+
+            double vscale = 0.0;
+            for (double v : values) vscale = std::max(vscale, std::abs(v));
+            if (vscale == 0.0) return ChebyshevProxy({0.0}, a, b);
+
+            double tol = 16.0 * eps * std::log2(static_cast<double>(n)) * vscale;
+            size_t tail = std::max<size_t>(4, n / 8);
+            double tailMax = 0.0;
+            for (size_t k = n + 1 - tail; k <= n; k++) tailMax = std::max(tailMax, std::abs(c[k]));
+
+            if (tailMax <= tol || 2 * n > maxDegree) {
+                bool converged = tailMax <= tol;
+                if (converged) {
+                    while (c.size() > 1 && std::abs(c.back()) <= tol) c.pop_back();
+                }
+                return ChebyshevProxy(std::move(c), a, b, converged);
+            }
+
+            std::vector<double> refined(2 * n + 1);
+            for (size_t j = 0; j <= 2 * n; j++) {
+                refined[j] = (j % 2 == 0) ? values[j / 2] : sample(j, 2 * n);
+            }
+            values.swap(refined);
+            n *= 2;
+        }
+    }
+
+    double operator()(double x) const {
+        checkInside(x);
+        return clenshaw(coeffs, toUnit(x));
+    }
+    double evaluate(double x) const { return (*this)(x); }
+
+    // Proxy for f'(x)
+    ChebyshevProxy derivative() const { return ChebyshevProxy(derivCoeffs, a, b, resolved); }
+
+    double derivative(double x) const {
+        checkInside(x);
+        return clenshaw(derivCoeffs, toUnit(x));
+    }
+
+    // Proxy for F(x) = ∫ₐˣ f(s) ds
+    ChebyshevProxy antiderivative() const {
+        size_t n = coeffs.size() - 1;
+        std::vector<double> c(coeffs);
+        c.resize(n + 3, 0.0);
+        std::vector<double> C(n + 2, 0.0);
+        C[1] = c[0] - 0.5 * c[2];
+        for (size_t k = 2; k <= n + 1; k++) {
+            C[k] = (c[k - 1] - c[k + 1]) / (2.0 * k);
+        }
+        // Choose C_0 so that F(a) = 0, using T_k(-1) = (-1)^k
+        double atA = 0.0;
+        for (size_t k = 1; k <= n + 1; k++) atA += (k % 2 == 0) ? C[k] : -C[k];
+        C[0] = -atA;
+        for (double& Ck : C) Ck *= 0.5 * (b - a);
+        return ChebyshevProxy(std::move(C), a, b, resolved);
+    }
+
+    // ∫ₐᵇ f(x) dx (Clenshaw-Curtis weights: ∫T_k = 2 / (1 - k²) for even k)
+    double integral() const {
+        double sum = 0.0;
+        for (size_t k = 0; k < coeffs.size(); k += 2) {
+            sum += coeffs[k] * 2.0 / (1.0 - static_cast<double>(k * k));
+        }
+        return 0.5 * (b - a) * sum;
+    }
+
+    // ∫ f(x) dx over [lower, upper] ⊆ [a, b]
+    double integral(double lower, double upper) const {
+        if (lower < a || lower > b || upper < a || upper > b) {
+            throw std::invalid_argument("Integration bounds must lie within the proxy interval");
+        }
+        ChebyshevProxy F = antiderivative();
+        return F(upper) - F(lower);
+    }
+
+    // All real roots of f in [a, b]
+    // An unresolved proxy (e.g. of a non-smooth f) has no reliable roots, and
+    // its degree would make the colleague-matrix subdivision very expensive
+    std::vector<double> roots() const {
+        if (!resolved) {
+            throw std::runtime_error("Proxy is not resolved; roots are unreliable");
+        }
+        std::vector<double> result;
+        // Clamp so a root at an endpoint stays a valid query point
+        for (double t : unitRoots(coeffs)) result.push_back(std::clamp(fromUnit(t), a, b));
+        return result;
+    }
+
+    // Points in [a, b] where f'(x) = 0
+    std::vector<double> findCriticalPoints() const { return derivative().roots(); }
+
+    size_t degree() const { return coeffs.size() - 1; }
+    bool isResolved() const { return resolved; }
+    double lowerBound() const { return a; }
+    double upperBound() const { return b; }
+    const std::vector<double>& coefficients() const { return coeffs; }
+};
+
+// Outcome of an extrapolated limit, derivative, or series sum
+enum class ExtrapolationStatus {
+    Converged,      // error estimate is within the calculator's epsilon
+    NotConverged,   // best estimate so far; tolerance was not reached
+    LimitMismatch,  // one-sided limits disagree beyond their error estimates
+    NonFinite       // a sample or intermediate value was not finite
+};
+
+struct ExtrapolationResult {
+    double value;
+    double errorEstimate;
+    int evaluations;
+    ExtrapolationStatus status;
+};
 
 class CalculusCalculator {
 private:
     double epsilon;
 
+    // Extrapolate sample(h) to h → 0 using Neville's tableau on steps
+    // h_k = h / ratio^k, assuming the error is a series in h^order.
+    // Stops once the estimate meets epsilon or rounding error starts to grow.
+    // A non-finite first sample (h reaches outside f's domain) shrinks h and
+    // retries, up to maxShrinks times, before reporting NonFinite.
+    ExtrapolationResult extrapolateToZero(std::function<double(double)> sample, double h,
+                                          double ratio, int order, int maxRows = 12,
+                                          int maxShrinks = 30) {
+        std::vector<std::vector<double>> T(maxRows);
+        ExtrapolationResult best = {0.0, std::numeric_limits<double>::infinity(), 0,
+                                    ExtrapolationStatus::NotConverged};
+
+        for (int i = 0; i < maxRows; i++) {
+            T[i].resize(i + 1);
+            T[i][0] = sample(h);
+            best.evaluations++;
+            if (i == 0 && !std::isfinite(T[0][0])) {
+                while (!std::isfinite(T[0][0]) && maxShrinks-- > 0) {
+                    h /= ratio;
+                    T[0][0] = sample(h);
+                    best.evaluations++;
+                }
+                // The first finite step sits right at the domain's edge, where
+                // f varies fastest; start the tableau a decade further in
+                if (std::isfinite(T[0][0])) {
+                    h /= 10.0;
+                    T[0][0] = sample(h);
+                    best.evaluations++;
+                }
+            }
+            if (!std::isfinite(T[i][0])) {
+                if (i == 0) best.value = T[i][0];
+                best.status = ExtrapolationStatus::NonFinite;
+                return best;
+            }
+            if (i == 0) best.value = T[0][0];
+
+            double factor = 1.0;
+            for (int j = 1; j <= i; j++) {
+                factor *= std::pow(ratio, order);
+                T[i][j] = T[i][j - 1] + (T[i][j - 1] - T[i - 1][j - 1]) / (factor - 1.0);
+                double err = std::max(std::abs(T[i][j] - T[i][j - 1]),
+                                      std::abs(T[i][j] - T[i - 1][j - 1]));
+                if (err <= best.errorEstimate) {
+                    best.value = T[i][j];
+                    best.errorEstimate = err;
+                }
+            }
+
+            if (best.errorEstimate <= epsilon * std::max(1.0, std::abs(best.value))) {
+                best.status = ExtrapolationStatus::Converged;
+                return best;
+            }
+            if (i > 0 && std::abs(T[i][i] - T[i - 1][i - 1]) >= 2.0 * best.errorEstimate) {
+                return best;
+            }
+            h /= ratio;
+        }
+        return best;
+    }
+
+    // Shared bookkeeping for the series accelerators: stop when successive
+    // estimates agree to epsilon or values stop being finite. estimate() may
+    // return false to produce no estimate for a step (e.g. a zero term).
+    // Isolated zero terms (as in Taylor series of odd or even functions) are
+    // part of the series, but a run of more than maxZeroRun of them is taken
+    // to mean it has terminated, and the exact partial sum is returned.
+    // Accelerated estimates eventually lose digits to cancellation, so the
+    // best one seen is kept and returned once several steps fail to improve it.
+    ExtrapolationResult accelerateSeries(std::function<double(int)> term, int maxTerms,
+                                         std::function<bool(int, double, double, double&)> estimate) {
+        ExtrapolationResult result = {0.0, std::numeric_limits<double>::infinity(), 0,
+                                      ExtrapolationStatus::NotConverged};
+        ExtrapolationResult best = result;
+        const int maxZeroRun = 2;
+        int zeroRun = 0;
+        int estimates = 0;
+        int bestEstimate = 0;
+        double partialSum = 0.0;
+        double previous = std::numeric_limits<double>::quiet_NaN();
+
+        for (int n = 0; n < maxTerms; n++) {
+            double a = term(n);
+            result.evaluations++;
+            partialSum += a;
+            if (!std::isfinite(partialSum)) {
+                result.value = partialSum;
+                result.status = ExtrapolationStatus::NonFinite;
+                return result;
+            }
+            zeroRun = (a == 0.0) ? zeroRun + 1 : 0;
+            if (zeroRun > maxZeroRun) {
+                result.value = partialSum;
+                result.errorEstimate = 0.0;
+                result.status = ExtrapolationStatus::Converged;
+                return result;
+            }
+
+            double current;
+            if (!estimate(n, a, partialSum, current)) {
+                if (estimates == 0) best.value = partialSum;
+                continue;
+            }
+            if (!std::isfinite(current)) {
+                if (estimates == 0) best.value = current;
+                best.evaluations = result.evaluations;
+                best.status = ExtrapolationStatus::NonFinite;
+                return best;
+            }
+            result.value = current;
+            if (estimates > 0) {
+                result.errorEstimate = std::abs(current - previous);
+                if (result.errorEstimate <= epsilon * std::max(1.0, std::abs(current))) {
+                    result.status = ExtrapolationStatus::Converged;
+                    return result;
+                }
+            }
+            if (estimates == 0 || result.errorEstimate < best.errorEstimate) {
+                best = result;
+                bestEstimate = estimates;
+            } else if (estimates - bestEstimate >= 4) {
+                break;
+            }
+            previous = current;
+            estimates++;
+        }
+        best.evaluations = result.evaluations;
+        return best;
+    }
+
 public:
     CalculusCalculator(double eps = 1e-7) : epsilon(eps) {}
 
@@ -73,6 +655,132 @@ public:
             throw std::runtime_error("Limit does not exist");
         }
     }
+
+    // Derivative by Ridders' method: central differences at shrinking steps
+    // extrapolated to h = 0 (error terms in h², so each column gains two orders).
+    // The starting step is h·max(1, |x|), so it scales with the magnitude of x.
+    ExtrapolationResult derivativeRichardson(std::function<double(double)> f, double x,
+                                             double h = 0.1) {
+        auto centralDifference = [&f, x](double step) {
+            return (f(x + step) - f(x - step)) / (2.0 * step);
+        };
+        ExtrapolationResult result = extrapolateToZero(centralDifference,
+                                                       h * std::max(1.0, std::abs(x)), 1.4, 2);
+        result.evaluations *= 2;
+        return result;
+    }
+
+    // Limit as t → x by extrapolating f(x ± h/2^k) to h = 0 from each side.
+    // Unlike limit(), f is never evaluated at x and failure is reported by status.
+    // As for derivativeRichardson, the starting step is h·max(1, |x|).
+    ExtrapolationResult limitExtrapolated(std::function<double(double)> f, double x,
+                                          double h = 0.1) {
+        h *= std::max(1.0, std::abs(x));
+        ExtrapolationResult left = extrapolateToZero([&f, x](double step) { return f(x - step); },
+                                                     h, 2.0, 1);
+        ExtrapolationResult right = extrapolateToZero([&f, x](double step) { return f(x + step); },
+                                                      h, 2.0, 1);
+
+        ExtrapolationResult result;
+        result.value = 0.5 * (left.value + right.value);
+        result.errorEstimate = std::max(left.errorEstimate, right.errorEstimate) +
+                               0.5 * std::abs(left.value - right.value);
+        result.evaluations = left.evaluations + right.evaluations;
+
+        double tol = epsilon * std::max(1.0, std::abs(result.value));
+        if (left.status == ExtrapolationStatus::NonFinite ||
+            right.status == ExtrapolationStatus::NonFinite) {
+            result.status = ExtrapolationStatus::NonFinite;
+        } else if (std::abs(left.value - right.value) >
+                   tol + left.errorEstimate + right.errorEstimate) {
+            result.status = ExtrapolationStatus::LimitMismatch;
+        } else if (result.errorEstimate <= tol) {
+            result.status = ExtrapolationStatus::Converged;
+        } else {
+            result.status = ExtrapolationStatus::NotConverged;
+        }
+        return result;
+    }
+
+    // Sum Σₙ term(n), n = 0, 1, 2, ..., with Wynn's epsilon algorithm.
+    // Each new partial sum updates one counter-diagonal of the epsilon table;
+    // the even columns hold the accelerated estimates. A zero term repeats the
+    // previous partial sum, which would make successive estimates agree
+    // spuriously, so the table is built from the non-zero terms only.
+    ExtrapolationResult seriesSumWynn(std::function<double(int)> term, int maxTerms = 60) {
+        std::vector<double> e;
+        return accelerateSeries(term, maxTerms, [&e](int, double a, double partialSum,
+                                                     double& estimate) {
+            if (a == 0.0) return false;
+            int n = static_cast<int>(e.size());
+            e.push_back(partialSum);
+            double aux2 = 0.0;
+            for (int j = n; j >= 1; j--) {
+                double aux1 = aux2;
+                aux2 = e[j - 1];
+                double diff = e[j] - aux2;
+                e[j - 1] = (diff == 0.0) ? std::numeric_limits<double>::max() : aux1 + 1.0 / diff;
+            }
+            estimate = (n % 2 == 0) ? e[0] : e[1];
+            return true;
+        });
+    }
+
+    // Sum Σₙ term(n) with Levin's u-transform, which uses the terms themselves
+    // as remainder estimates ωₖ = (k + 1)·aₖ and suits both alternating and
+    // logarithmically converging series. Zero terms would make ωₖ = 0, so they
+    // are skipped and the transform runs over the non-zero terms only.
+    ExtrapolationResult seriesSumLevin(std::function<double(int)> term, int maxTerms = 60) {
+        std::vector<double> sums, omegas;
+        return accelerateSeries(term, maxTerms, [&](int, double a, double partialSum,
+                                                    double& estimate) {
+            if (a == 0.0) return false;
+            int n = static_cast<int>(sums.size());
+            sums.push_back(partialSum);
+            omegas.push_back((n + 1.0) * a);
+
+            // L_n = Σⱼ (-1)ʲ C(n,j) ((j+1)/(n+1))^(n-1) Sⱼ/ωⱼ / Σⱼ (same) 1/ωⱼ
+            double numerator = 0.0, denominator = 0.0, binomial = 1.0;
+            for (int j = 0; j <= n; j++) {
+                double weight = binomial * std::pow((j + 1.0) / (n + 1.0), n - 1) / omegas[j];
+                if (j % 2 == 1) weight = -weight;
+                numerator += weight * sums[j];
+                denominator += weight;
+                binomial *= static_cast<double>(n - j) / (j + 1);
+            }
+            // Equal remainder estimates can cancel the denominator; wait for the next term
+            if (denominator == 0.0) return false;
+            estimate = numerator / denominator;
+            return true;
+        });
+    }
+
+    // Build a Chebyshev proxy of f on [a, b] for repeated fast queries
+    ChebyshevProxy chebyshevProxy(std::function<double(double)> f, double a, double b) {
+        return ChebyshevProxy::build(f, a, b);
+    }
+
+    // Exact derivative of a Chebyshev proxy (no finite-difference error)
+    double derivative(const ChebyshevProxy& proxy, double x) {
+        return proxy.derivative(x);
+    }
+
+    // Definite integral of a Chebyshev proxy over [a, b] inside its interval
+    double integral(const ChebyshevProxy& proxy, double a, double b) {
+        return proxy.integral(a, b);
+    }
+
+    // Critical points of a Chebyshev proxy in [a, b] from the roots of its derivative
+    std::vector<double> findCriticalPoints(const ChebyshevProxy& proxy, double a, double b) {
+        if (!(a >= proxy.lowerBound() && b <= proxy.upperBound() && a <= b)) {
+            throw std::invalid_argument("Search interval must lie within the proxy interval");
+        }
+        std::vector<double> criticalPoints;
+        for (double x : proxy.findCriticalPoints()) {
+            if (x >= a && x <= b) criticalPoints.push_back(x);
+        }
+        return criticalPoints;
+    }
 };
 
 int main() {
@@ -153,6 +861,114 @@ int main() {
     std::cout << "f'(" << x << ") numerical ≈ " << numerical << std::endl;
     std::cout << "f'(" << x << ") analytical = " << analytical << " ✓" << std::endl;
 
+    // Example 8: Chebyshev proxy - sample once, query many times
+    std::cout << "\n6. CHEBYSHEV PROXY" << std::endl;
+    std::cout << std::string(60, '-') << std::endl;
+    int evaluations = 0;
+    auto f8 = [&evaluations](double x) {
+        evaluations++;
+        return std::exp(x) * std::sin(5.0 * x);
+    };
+    ChebyshevProxy proxy = calc.chebyshevProxy(f8, -1.0, 2.0);
+    std::cout << "f(x) = eˣ·sin(5x) on [-1, 2]" << std::endl;
+    std::cout << "Degree " << proxy.degree() << " from " << evaluations
+              << " evaluations of f" << std::endl;
+    x = 0.5;
+    std::cout << "f'(" << x << ") ≈ " << std::setprecision(12) << calc.derivative(proxy, x)
+              << std::endl;
+    std::cout << "Analytical: eˣ(sin(5x) + 5cos(5x)) = "
+              << std::exp(x) * (std::sin(5.0 * x) + 5.0 * std::cos(5.0 * x)) << " ✓" << std::endl;
+    std::cout << "∫₋₁² f(x) dx ≈ " << calc.integral(proxy, -1.0, 2.0) << std::endl;
+    auto F = [](double t) { return std::exp(t) * (std::sin(5.0 * t) - 5.0 * std::cos(5.0 * t)) / 26.0; };
+    std::cout << "Analytical: [eˣ(sin(5x) - 5cos(5x))/26]₋₁² = " << F(2.0) - F(-1.0) << " ✓"
+              << std::endl;
+    std::cout << std::setprecision(6);
+
+    std::vector<double> roots = proxy.roots();
+    std::cout << "Roots in [-1, 2]: [";
+    for (size_t i = 0; i < roots.size(); i++) {
+        std::cout << roots[i];
+        if (i < roots.size() - 1) std::cout << ", ";
+    }
+    std::cout << "]" << std::endl;
+    std::cout << "Analytical: x = kπ/5 ✓" << std::endl;
+
+    // High degree, non-symmetric: exercises subdivision of the colleague matrix
+    ChebyshevProxy wave = calc.chebyshevProxy(
+        [](double t) { return std::cos(60.0 * t) * std::exp(t); }, -1.0, 1.0);
+    int expectedRoots = 2 * static_cast<int>(std::floor(60.0 / M_PI - 0.5) + 1.0);
+    std::cout << "\nf(x) = cos(60x)·eˣ on [-1, 1], degree " << wave.degree() << std::endl;
+    std::cout << "Roots found: " << wave.roots().size() << std::endl;
+    std::cout << "Analytical: x = (k + ½)π/60, " << expectedRoots << " roots in [-1, 1] ✓" << std::endl;
+
+    ChebyshevProxy cubic = calc.chebyshevProxy(f6, -2.0, 2.0);
+    critical = calc.findCriticalPoints(cubic, -2.0, 2.0);
+    std::cout << "\nf(x) = x³ - 3x, critical points from proxy: [";
+    for (size_t i = 0; i < critical.size(); i++) {
+        std::cout << critical[i];
+        if (i < critical.size() - 1) std::cout << ", ";
+    }
+    std::cout << "]" << std::endl;
+    std::cout << "All proxy queries above used only " << evaluations << " calls to eˣ·sin(5x) ✓" << std::endl;
+
+    // Example 9: Extrapolation and series acceleration
+    std::cout << "\n7. EXTRAPOLATION AND SERIES ACCELERATION" << std::endl;
+    std::cout << std::string(60, '-') << std::endl;
+    CalculusCalculator precise(1e-12);
+    auto statusName = [](ExtrapolationStatus status) {
+        switch (status) {
+            case ExtrapolationStatus::Converged: return "converged";
+            case ExtrapolationStatus::NotConverged: return "not converged";
+            case ExtrapolationStatus::LimitMismatch: return "one-sided limits differ";
+            case ExtrapolationStatus::NonFinite: return "non-finite";
+        }
+        return "unknown";
+    };
+    auto report = [&statusName](const std::string& label, const ExtrapolationResult& r) {
+        std::cout << label << " ≈ " << std::setprecision(12) << r.value
+                  << " (error ≈ " << std::scientific << std::setprecision(1) << r.errorEstimate
+                  << std::fixed << ", " << r.evaluations << " evaluations, "
+                  << statusName(r.status) << ")" << std::endl;
+    };
+
+    auto f9 = [](double t) { return std::pow(1.0 + t, 1.0 / t); };
+    std::cout << "lim(x→0) (1 + x)^(1/x):" << std::endl;
+    try {
+        calc.limit(f9, 0.0);
+    } catch (const std::runtime_error& e) {
+        std::cout << "limit() with x ± 1e-6 probes: " << e.what() << std::endl;
+    }
+    report("limitExtrapolated()", precise.limitExtrapolated(f9, 0.0));
+    std::cout << "Analytical: e = " << std::setprecision(12) << M_E << " ✓" << std::endl;
+
+    auto f10 = [](double t) { return (t > 0.0) ? 1.0 : -1.0; };
+    report("lim(x→0) sign(x)", precise.limitExtrapolated(f10, 0.0));
+
+    report("\nd/dx sin(x) at x = 1", precise.derivativeRichardson(f2, 1.0));
+    std::cout << "Analytical: cos(1) = " << std::setprecision(12) << std::cos(1.0) << " ✓" << std::endl;
+
+    std::cout << "\nΣ 0.9ⁿ (a direct sum needs ~260 terms for 1e-12)" << std::endl;
+    report("Wynn epsilon", precise.seriesSumWynn([](int n) { return std::pow(0.9, n); }));
+    std::cout << "Analytical: 1 / (1 - 0.9) = 10 ✓" << std::endl;
+
+    std::cout << "\nΣ (-1)ⁿ/(n + 1) (a direct sum needs ~10¹² terms)" << std::endl;
+    auto alternating = [](int n) { return ((n % 2 == 0) ? 1.0 : -1.0) / (n + 1.0); };
+    report("Wynn epsilon", precise.seriesSumWynn(alternating));
+    report("Levin u", precise.seriesSumLevin(alternating));
+    std::cout << "Analytical: ln 2 = " << std::setprecision(12) << std::log(2.0) << " ✓" << std::endl;
+
+    std::cout << "\nsin(1) = Σ aₙ with aₙ = 0 for even n (Taylor series)" << std::endl;
+    auto sineTerm = [](int n) {
+        if (n % 2 == 0) return 0.0;
+        double term = 1.0;
+        for (int k = 2; k <= n; k++) term /= k;
+        return ((n / 2) % 2 == 0) ? term : -term;
+    };
+    report("Wynn epsilon", precise.seriesSumWynn(sineTerm));
+    report("Levin u", precise.seriesSumLevin(sineTerm));
+    std::cout << "Analytical: sin(1) = " << std::setprecision(12) << std::sin(1.0) << " ✓" << std::endl;
+    std::cout << std::setprecision(6);
+
     std::cout << "\n" << std::string(60, '=') << std::endl;
 
     return 0;
@@ -0,0 +1,833 @@
+// Statistics Calculator - C++ Implementation
+// Demonstrates descriptive statistics, streaming multivariate least-squares
+// regression, and parallel bootstrap / permutation resampling
+
+#include <iostream>
+#include <cmath>
+#include <functional>
+#include <vector>
+#include <iomanip>
+#include <string>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <exception>
+#include <random>
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <memory>
+
+class StatisticsCalculator {
+public:
+    // Calculate arithmetic mean (average)
+    static double mean(const std::vector<double>& data) {
+        double sum = 0.0;
+        for (double x : data) sum += x;
+        return sum / data.size();
+    }
+
+    // Sample variance (n - 1) or population variance (n)
+    static double variance(const std::vector<double>& data, bool sample = true) {
+        double meanVal = mean(data);
+        double sumSquaredDiff = 0.0;
+        for (double x : data) sumSquaredDiff += (x - meanVal) * (x - meanVal);
+        return sumSquaredDiff / (sample ? data.size() - 1 : data.size());
+    }
+
+    // Calculate standard deviation
+    static double stdDev(const std::vector<double>& data, bool sample = true) {
+        return std::sqrt(variance(data, sample));
+    }
+
+    // Pearson correlation coefficient
+    // r = Σ((x - x̄)(y - ȳ)) / √(Σ(x - x̄)² * Σ(y - ȳ)²)
+    static double correlation(const std::vector<double>& x, const std::vector<double>& y) {
+        if (x.size() != y.size()) {
+            throw std::invalid_argument("Vectors must have same length");
+        }
+        double meanX = mean(x), meanY = mean(y);
+        double numerator = 0.0, sumXSq = 0.0, sumYSq = 0.0;
+        for (size_t i = 0; i < x.size(); i++) {
+            numerator += (x[i] - meanX) * (y[i] - meanY);
+            sumXSq += (x[i] - meanX) * (x[i] - meanX);
+            sumYSq += (y[i] - meanY) * (y[i] - meanY);
+        }
+        double denominator = std::sqrt(sumXSq * sumYSq);
+        return (denominator != 0.0) ? numerator / denominator : 0.0;
+    }
+};
+
+// Fitted model and goodness-of-fit summary
+struct RegressionResult {
+    std::vector<double> coefficients;   // intercept first when fitted
+    double rSquared;
+    double adjustedRSquared;
+    double residualSumSquares;
+    double totalSumSquares;
+    double residualStdError;            // √(RSS / (n - p))
+    size_t observations;
+    size_t degreesOfFreedom;
+};
+
+// Streaming least-squares accumulator
+// Rows are buffered in cache-sized blocks and folded into the upper-triangular
+// factor R of the augmented matrix [X | y] (tall-skinny QR), so the design
+// matrix is never stored. X'X = R'R, and R's last diagonal entry squared is
+// the residual sum of squares. Accumulators built on separate threads merge
+// by stacking their factors and re-triangularising.
+class RegressionAccumulator {
+private:
+    size_t features;
+    bool intercept;
+    size_t cols;                // model columns + 1 for y
+    std::vector<double> R;      // cols x cols, row-major, upper triangular
+    std::vector<double> block;  // pending rows, row-major
+    size_t blockRows;
+    size_t pending;
+
+    // Weighted running mean and M2 of y (for the total sum of squares)
+    size_t count;
+    double weightSum;
+    double meanY;
+    double m2Y;
+
+    // Fold m rows of width cols into the triangular factor using Householder
+    // reflections. Below the diagonal only the incoming rows are non-zero, so
+    // each reflector touches row j of R and column j of the block alone.
+    static void absorb(std::vector<double>& R, double* rows, size_t m, size_t cols) {
+        std::vector<double> s(cols);
+        for (size_t j = 0; j < cols; j++) {
+            double alpha = R[j * cols + j];
+            double tailNorm2 = 0.0;
+            for (size_t i = 0; i < m; i++) {
+                double v = rows[i * cols + j];
+                tailNorm2 += v * v;
+            }
+            if (tailNorm2 == 0.0) continue;
+
+            double beta = -std::copysign(std::sqrt(alpha * alpha + tailNorm2), alpha);
+            double v0 = alpha - beta;
+            double tau = (beta - alpha) / beta;
+            for (size_t i = 0; i < m; i++) rows[i * cols + j] /= v0;
+
+            // s = tau * vᵀ[R_j; rows] for the remaining columns, row by row
+            for (size_t k = j + 1; k < cols; k++) s[k] = R[j * cols + k];
+            for (size_t i = 0; i < m; i++) {
+                const double* row = rows + i * cols;
+                double vi = row[j];
+                for (size_t k = j + 1; k < cols; k++) s[k] += vi * row[k];
+            }
+            for (size_t k = j + 1; k < cols; k++) {
+                s[k] *= tau;
+                R[j * cols + k] -= s[k];
+            }
+            for (size_t i = 0; i < m; i++) {
+                double* row = rows + i * cols;
+                double vi = row[j];
+                for (size_t k = j + 1; k < cols; k++) row[k] -= vi * s[k];
+                row[j] = 0.0;
+            }
+            R[j * cols + j] = beta;
+        }
+    }
+
+    void flush() {
+        if (pending == 0) return;
+        absorb(R, block.data(), pending, cols);
+        pending = 0;
+    }
+
+    // Back substitution for the leading p x p system of an augmented factor
+    std::vector<double> backSubstitute(const std::vector<double>& F) const {
+        size_t p = cols - 1;
+        double maxDiag = 0.0;
+        for (size_t j = 0; j < p; j++) maxDiag = std::max(maxDiag, std::abs(F[j * cols + j]));
+        // Rounding left on R's diagonal grows with the number of rows folded
+        // in, so an exactly collinear column leaves about eps·n·maxDiag
+        double rankTol = std::numeric_limits<double>::epsilon() *
+                         static_cast<double>(std::max(count, p)) * maxDiag;
+
+        std::vector<double> beta(p, 0.0);
+        for (size_t j = p; j-- > 0;) {
+            double diag = F[j * cols + j];
+            if (std::abs(diag) <= rankTol) {
+                throw std::runtime_error("Design matrix is rank deficient; use a ridge penalty");
+            }
+            double sum = F[j * cols + p];
+            for (size_t k = j + 1; k < p; k++) sum -= F[j * cols + k] * beta[k];
+            beta[j] = sum / diag;
+        }
+        return beta;
+    }
+
+public:
+    // blockBytes sizes the row buffer to stay resident in cache
+    RegressionAccumulator(size_t features, bool fitIntercept = true, size_t blockBytes = 256 * 1024)
+        : features(features), intercept(fitIntercept),
+          cols(features + (fitIntercept ? 1 : 0) + 1),
+          R(cols * cols, 0.0), pending(0),
+          count(0), weightSum(0.0), meanY(0.0), m2Y(0.0) {
+        if (cols < 2) {
+            throw std::invalid_argument("Model needs at least one column");
+        }
+        blockRows = std::max(cols, blockBytes / (cols * sizeof(double)));
+        block.resize(blockRows * cols);
+    }
+
+    // Add one observation with feature vector x (length = features)
+    void addRow(const double* x, double y, double weight = 1.0) {
+        if (weight < 0.0) {
+            throw std::invalid_argument("Weights must be non-negative");
+        }
+        if (weight == 0.0) return;
+
+        double w = std::sqrt(weight);
+        double* row = block.data() + pending * cols;
+        size_t c = 0;
+        if (intercept) row[c++] = w;
+        for (size_t i = 0; i < features; i++) row[c++] = w * x[i];
+        row[c] = w * y;
+        if (++pending == blockRows) flush();
+
+        count++;
+        weightSum += weight;
+        double delta = y - meanY;
+        meanY += (weight / weightSum) * delta;
+        m2Y += weight * delta * (y - meanY);
+    }
+
+    void addRow(const std::vector<double>& x, double y, double weight = 1.0) {
+        if (x.size() != features) {
+            throw std::invalid_argument("Row has wrong number of features");
+        }
+        addRow(x.data(), y, weight);
+    }
+
+    // Combine with an accumulator fed a disjoint set of rows
+    void merge(const RegressionAccumulator& other) {
+        if (other.features != features || other.intercept != intercept) {
+            throw std::invalid_argument("Cannot merge accumulators of different models");
+        }
+        flush();
+        std::vector<double> rows = other.R;
+        if (other.pending > 0) {
+            std::vector<double> tail(other.block.begin(), other.block.begin() + other.pending * cols);
+            absorb(rows, tail.data(), other.pending, cols);
+        }
+        absorb(R, rows.data(), cols, cols);
+
+        if (other.weightSum > 0.0) {
+            double total = weightSum + other.weightSum;
+            double delta = other.meanY - meanY;
+            m2Y += other.m2Y + delta * delta * weightSum * other.weightSum / total;
+            meanY += delta * other.weightSum / total;
+            weightSum = total;
+        }
+        count += other.count;
+    }
+
+    // Solve min Σ w (y - xβ)² + λ‖β‖² (the intercept is not penalised)
+    RegressionResult solve(double ridgeLambda = 0.0) const {
+        if (ridgeLambda < 0.0) {
+            throw std::invalid_argument("Ridge penalty must be non-negative");
+        }
+        size_t p = cols - 1;
+        if (count < p) {
+            throw std::runtime_error("Not enough observations for the model");
+        }
+
+        std::vector<double> F = R;
+        if (pending > 0) {
+            std::vector<double> tail(block.begin(), block.begin() + pending * cols);
+            absorb(F, tail.data(), pending, cols);
+        }
+
+        std::vector<double> beta;
+        if (ridgeLambda > 0.0) {
+            // Append √λ·I rows (with y = 0) and re-triangularise
+            std::vector<double> penalised = F;
+            size_t first = intercept ? 1 : 0;
+            std::vector<double> rows((p - first) * cols, 0.0);
+            for (size_t j = first; j < p; j++) rows[(j - first) * cols + j] = std::sqrt(ridgeLambda);
+            absorb(penalised, rows.data(), p - first, cols);
+            beta = backSubstitute(penalised);
+        } else {
+            beta = backSubstitute(F);
+        }
+
+        // RSS(β) = ‖y - Xβ‖² = r² + ‖z - Rβ‖², with z = Qᵀy and r = F[p][p]
+        double rss = F[p * cols + p] * F[p * cols + p];
+        for (size_t j = 0; j < p; j++) {
+            double diff = F[j * cols + p];
+            for (size_t k = j; k < p; k++) diff -= F[j * cols + k] * beta[k];
+            rss += diff * diff;
+        }
+
+        RegressionResult result;
+        result.coefficients = beta;
+        result.observations = count;
+        result.degreesOfFreedom = count - p;
+        result.residualSumSquares = rss;
+        result.totalSumSquares = intercept ? m2Y : m2Y + weightSum * meanY * meanY;
+        result.rSquared = (result.totalSumSquares > 0.0) ? 1.0 - rss / result.totalSumSquares : 0.0;
+        double baseDof = intercept ? count - 1.0 : static_cast<double>(count);
+        result.adjustedRSquared = (result.degreesOfFreedom > 0)
+            ? 1.0 - (1.0 - result.rSquared) * baseDof / result.degreesOfFreedom
+            : std::numeric_limits<double>::quiet_NaN();
+        result.residualStdError = (result.degreesOfFreedom > 0)
+            ? std::sqrt(rss / result.degreesOfFreedom)
+            : std::numeric_limits<double>::quiet_NaN();
+        return result;
+    }
+
+    size_t observations() const { return count; }
+};
+
+class RegressionEngine {
+public:
+    // Fill x (length = features), y and weight for the given row index
+    using RowSource = std::function<void(size_t row, double* x, double& y, double& weight)>;
+
+    // Fit over rows [0, rows) by splitting them across threads; each thread
+    // streams its range into a private accumulator and the partial factors
+    // are merged at the end. threads = 0 uses all hardware threads.
+    static RegressionResult fit(size_t rows, size_t features, RowSource source,
+                                double ridgeLambda = 0.0, bool fitIntercept = true,
+                                unsigned threads = 0) {
+        if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+        threads = static_cast<unsigned>(std::min<size_t>(threads, std::max<size_t>(rows, 1)));
+
+        // Each thread streams into an accumulator on its own stack and only
+        // publishes it after the loop; adjacent accumulators in a shared
+        // vector would false-share the cache line holding their counters
+        std::vector<std::unique_ptr<RegressionAccumulator>> partials(threads);
+        std::vector<std::exception_ptr> errors(threads);
+        std::vector<std::thread> workers;
+
+        auto work = [&](unsigned t) {
+            try {
+                RegressionAccumulator local(features, fitIntercept);
+                size_t begin = rows * t / threads;
+                size_t end = rows * (t + 1) / threads;
+                std::vector<double> x(features);
+                for (size_t i = begin; i < end; i++) {
+                    double y = 0.0, weight = 1.0;
+                    source(i, x.data(), y, weight);
+                    local.addRow(x.data(), y, weight);
+                }
+                partials[t] = std::make_unique<RegressionAccumulator>(std::move(local));
+            } catch (...) {
+                errors[t] = std::current_exception();
+            }
+        };
+
+        for (unsigned t = 1; t < threads; t++) workers.emplace_back(work, t);
+        work(0);
+        for (auto& worker : workers) worker.join();
+        for (auto& error : errors) {
+            if (error) std::rethrow_exception(error);
+        }
+
+        for (unsigned t = 1; t < threads; t++) partials[0]->merge(*partials[t]);
+        return partials[0]->solve(ridgeLambda);
+    }
+
+    // Simple linear regression y = mx + b, returns (slope, intercept)
+    static std::pair<double, double> linearRegression(const std::vector<double>& x,
+                                                      const std::vector<double>& y) {
+        if (x.size() != y.size()) {
+            throw std::invalid_argument("Vectors must have same length");
+        }
+        RegressionAccumulator acc(1);
+        for (size_t i = 0; i < x.size(); i++) acc.addRow(&x[i], y[i]);
+        RegressionResult result = acc.solve();
+        return {result.coefficients[1], result.coefficients[0]};
+    }
+};
+
+// Philox4x32-10 counter-based random number generator (Salmon et al., 2011)
+// Output is a pure function of (counter, key), so any resample can be
+// regenerated independently on any thread without sharing generator state.
+class PhiloxStream {
+private:
+    std::array<uint32_t, 4> counter;
+    std::array<uint32_t, 2> key;
+    std::array<uint32_t, 4> buffer;
+    int used;
+
+    static void mulhilo(uint32_t a, uint32_t b, uint32_t& hi, uint32_t& lo) {
+        uint64_t product = static_cast<uint64_t>(a) * b;
+        hi = static_cast<uint32_t>(product >> 32);
+        lo = static_cast<uint32_t>(product);
+    }
+
+    void refill() {
+        std::array<uint32_t, 4> x = counter;
+        std::array<uint32_t, 2> k = key;
+        for (int round = 0; round < 10; round++) {
+            uint32_t hi0, lo0, hi1, lo1;
+            mulhilo(0xD2511F53u, x[0], hi0, lo0);
+            mulhilo(0xCD9E8D57u, x[2], hi1, lo1);
+            x = {hi1 ^ x[1] ^ k[0], lo1, hi0 ^ x[3] ^ k[1], lo0};
+            k[0] += 0x9E3779B9u;
+            k[1] += 0xBB67AE85u;
+        }
+        buffer = x;
+        used = 0;
+        if (++counter[0] == 0) ++counter[1];
+    }
+
+public:
+    // Stream number selects an independent sequence for the given seed
+    PhiloxStream(uint64_t seed, uint64_t stream)
+        : counter{0u, 0u, static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32)},
+          key{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)},
+          buffer{}, used(4) {}
+
+    uint32_t next() {
+        if (used == 4) refill();
+        return buffer[used++];
+    }
+
+    // Index in [0, n) by multiply-shift (bias below n / 2³², negligible here)
+    // The 32-bit draw times n must fit in 64 bits, which limits n to 2³²
+    size_t uniformIndex(size_t n) {
+        if (static_cast<uint64_t>(n) > (uint64_t(1) << 32)) {
+            throw std::out_of_range("uniformIndex supports at most 2^32 indices");
+        }
+        return static_cast<size_t>((static_cast<uint64_t>(next()) * n) >> 32);
+    }
+};
+
+// Running mean and M2 (Welford), mergeable across threads (Chan et al.)
+struct MomentAccumulator {
+    size_t count = 0;
+    double mean = 0.0;
+    double m2 = 0.0;
+
+    void add(double x) {
+        count++;
+        double delta = x - mean;
+        mean += delta / count;
+        m2 += delta * (x - mean);
+    }
+
+    void merge(const MomentAccumulator& other) {
+        if (other.count == 0) return;
+        size_t total = count + other.count;
+        double delta = other.mean - mean;
+        m2 += other.m2 + delta * delta * count * other.count / total;
+        mean += delta * other.count / total;
+        count = total;
+    }
+
+    double variance() const { return (count > 1) ? m2 / (count - 1) : 0.0; }
+};
+
+struct BootstrapResult {
+    double estimate;        // statistic on the original sample
+    double standardError;   // standard deviation of the replicates
+    double bias;            // mean of replicates - estimate
+    double lower;           // percentile confidence interval
+    double upper;
+    double confidence;
+    size_t resamples;
+};
+
+struct PermutationResult {
+    double observed;        // statistic on the original pairing / grouping
+    double pValue;          // two-sided, (extreme + 1) / (permutations + 1)
+    size_t extreme;         // permutations with |statistic| >= |observed|
+    size_t permutations;
+};
+
+// Bootstrap and permutation resampling
+// A resample is just a vector of row indices; statistics read the original
+// data through it, so nothing is copied. Resample b always draws from Philox
+// stream b, which makes results identical for any number of threads.
+class ResamplingEngine {
+public:
+    // Statistics are called concurrently from every worker thread, each with
+    // its own index vector, so a user-supplied one must be thread-safe (read
+    // shared data only). The built-in ones below keep a reference to their
+    // data, which must outlive the statistic; temporaries are rejected.
+    using IndexStatistic = std::function<double(const std::vector<size_t>& indices)>;
+
+    // Mean of data[indices]
+    static IndexStatistic meanStatistic(const std::vector<double>& data) {
+        return [&data](const std::vector<size_t>& indices) {
+            double sum = 0.0;
+            for (size_t i : indices) sum += data[i];
+            return sum / indices.size();
+        };
+    }
+    static IndexStatistic meanStatistic(std::vector<double>&&) = delete;
+
+    // Sample standard deviation of data[indices]
+    static IndexStatistic stdDevStatistic(const std::vector<double>& data) {
+        return [&data](const std::vector<size_t>& indices) {
+            MomentAccumulator acc;
+            for (size_t i : indices) acc.add(data[i]);
+            return std::sqrt(acc.variance());
+        };
+    }
+    static IndexStatistic stdDevStatistic(std::vector<double>&&) = delete;
+
+    // Pearson correlation of the pairs (x[indices[i]], y[indices[i]])
+    static IndexStatistic correlationStatistic(const std::vector<double>& x,
+                                               const std::vector<double>& y) {
+        return pairedCorrelation(x, y, true);
+    }
+    static IndexStatistic correlationStatistic(std::vector<double>&&, const std::vector<double>&) = delete;
+    static IndexStatistic correlationStatistic(const std::vector<double>&, std::vector<double>&&) = delete;
+    static IndexStatistic correlationStatistic(std::vector<double>&&, std::vector<double>&&) = delete;
+
+    // Pearson correlation of x[i] against y[indices[i]], for permutation tests
+    static IndexStatistic permutedCorrelationStatistic(const std::vector<double>& x,
+                                                       const std::vector<double>& y) {
+        return pairedCorrelation(x, y, false);
+    }
+    static IndexStatistic permutedCorrelationStatistic(std::vector<double>&&,
+                                                       const std::vector<double>&) = delete;
+    static IndexStatistic permutedCorrelationStatistic(const std::vector<double>&,
+                                                       std::vector<double>&&) = delete;
+    static IndexStatistic permutedCorrelationStatistic(std::vector<double>&&,
+                                                       std::vector<double>&&) = delete;
+
+    // mean(pooled[indices[0..n1)]) - mean(pooled[indices[n1..)]) for two-sample tests
+    static IndexStatistic meanDifferenceStatistic(const std::vector<double>& pooled, size_t n1) {
+        if (n1 == 0 || n1 >= pooled.size()) {
+            throw std::invalid_argument("Both groups must be non-empty");
+        }
+        return [&pooled, n1](const std::vector<size_t>& indices) {
+            double sum1 = 0.0, sum2 = 0.0;
+            for (size_t i = 0; i < n1; i++) sum1 += pooled[indices[i]];
+            for (size_t i = n1; i < indices.size(); i++) sum2 += pooled[indices[i]];
+            return sum1 / n1 - sum2 / (indices.size() - n1);
+        };
+    }
+    static IndexStatistic meanDifferenceStatistic(std::vector<double>&&, size_t) = delete;
+
+    // Percentile bootstrap confidence interval for a statistic of n rows
+    static BootstrapResult bootstrap(size_t n, IndexStatistic statistic, size_t resamples = 2000,
+                                     double confidence = 0.95, uint64_t seed = 20240601,
+                                     unsigned threads = 0) {
+        if (n == 0 || resamples == 0) {
+            throw std::invalid_argument("Need at least one row and one resample");
+        }
+        if (!(confidence > 0.0 && confidence < 1.0)) {
+            throw std::invalid_argument("Confidence must be in (0, 1)");
+        }
+
+        // Each thread fills its own slice of replicates, stored by resample
+        // number; the summary is then one pass in that fixed order, so every
+        // field of the result is independent of how the work was split
+        std::vector<double> replicates(resamples);
+        forEachResample(resamples, threads, [&](size_t b, std::vector<size_t>& indices) {
+            indices.resize(n);
+            PhiloxStream stream(seed, b);
+            for (size_t i = 0; i < n; i++) indices[i] = stream.uniformIndex(n);
+            replicates[b] = statistic(indices);
+        });
+
+        MomentAccumulator total;
+        for (double replicate : replicates) total.add(replicate);
+
+        std::vector<size_t> identity(n);
+        std::iota(identity.begin(), identity.end(), 0);
+
+        BootstrapResult result;
+        result.estimate = statistic(identity);
+        result.standardError = std::sqrt(total.variance());
+        result.bias = total.mean - result.estimate;
+        result.confidence = confidence;
+        result.resamples = resamples;
+        double alpha = 0.5 * (1.0 - confidence);
+        result.lower = quantile(replicates, alpha);
+        result.upper = quantile(replicates, 1.0 - alpha);
+        return result;
+    }
+
+    // Two-sided permutation test: the statistic is recomputed on random
+    // permutations of the n row indices
+    static PermutationResult permutationTest(size_t n, IndexStatistic statistic,
+                                             size_t permutations = 5000,
+                                             uint64_t seed = 20240601, unsigned threads = 0) {
+        if (n == 0 || permutations == 0) {
+            throw std::invalid_argument("Need at least one row and one permutation");
+        }
+        std::vector<size_t> identity(n);
+        std::iota(identity.begin(), identity.end(), 0);
+        double observed = statistic(identity);
+        double threshold = std::abs(observed) * (1.0 - 1e-12);
+
+        std::vector<size_t> counts = forEachResample<size_t>(
+            permutations, threads, [&](size_t b, std::vector<size_t>& indices, size_t& extreme) {
+                // Shuffle from the identity so permutation b never depends on b - 1
+                indices = identity;
+                PhiloxStream stream(seed, b);
+                for (size_t i = n - 1; i > 0; i--) {
+                    std::swap(indices[i], indices[stream.uniformIndex(i + 1)]);
+                }
+                if (std::abs(statistic(indices)) >= threshold) extreme++;
+            });
+
+        PermutationResult result;
+        result.observed = observed;
+        result.permutations = permutations;
+        result.extreme = std::accumulate(counts.begin(), counts.end(), size_t(0));
+        result.pValue = (result.extreme + 1.0) / (permutations + 1.0);
+        return result;
+    }
+
+private:
+    static IndexStatistic pairedCorrelation(const std::vector<double>& x,
+                                            const std::vector<double>& y, bool resampleX) {
+        if (x.size() != y.size()) {
+            throw std::invalid_argument("Vectors must have same length");
+        }
+        return [&x, &y, resampleX](const std::vector<size_t>& indices) {
+            // Single pass co-moment update
+            double meanX = 0.0, meanY = 0.0, sxx = 0.0, syy = 0.0, sxy = 0.0;
+            for (size_t k = 0; k < indices.size(); k++) {
+                double xi = x[resampleX ? indices[k] : k];
+                double yi = y[indices[k]];
+                double dx = xi - meanX;
+                double dy = yi - meanY;
+                meanX += dx / (k + 1);
+                meanY += dy / (k + 1);
+                sxx += dx * (xi - meanX);
+                syy += dy * (yi - meanY);
+                sxy += dx * (yi - meanY);
+            }
+            double denominator = std::sqrt(sxx * syy);
+            return (denominator != 0.0) ? sxy / denominator : 0.0;
+        };
+    }
+
+    // Linear-interpolated quantile (reorders values)
+    static double quantile(std::vector<double>& values, double q) {
+        double pos = q * (values.size() - 1);
+        size_t lo = static_cast<size_t>(pos);
+        std::nth_element(values.begin(), values.begin() + lo, values.end());
+        double low = values[lo];
+        if (lo + 1 >= values.size()) return low;
+        double high = *std::min_element(values.begin() + lo + 1, values.end());
+        return low + (pos - lo) * (high - low);
+    }
+
+    // Split resamples [0, count) into contiguous ranges, one per thread; each
+    // thread owns its index buffer and the outputs for its own range
+    static void forEachResample(size_t count, unsigned threads,
+                                std::function<void(size_t, std::vector<size_t>&)> body) {
+        partitionResamples(count, threads, [&](unsigned, size_t begin, size_t end) {
+            std::vector<size_t> indices;
+            for (size_t b = begin; b < end; b++) body(b, indices);
+        });
+    }
+
+    // Same split, but each thread also owns an accumulator; the partials are
+    // returned in thread order for merging
+    template <typename Accumulator>
+    static std::vector<Accumulator> forEachResample(
+        size_t count, unsigned threads,
+        std::function<void(size_t, std::vector<size_t>&, Accumulator&)> body) {
+        std::vector<Accumulator> partials(workerCount(count, threads));
+        partitionResamples(count, threads, [&](unsigned t, size_t begin, size_t end) {
+            std::vector<size_t> indices;
+            Accumulator local{};
+            for (size_t b = begin; b < end; b++) body(b, indices, local);
+            partials[t] = local;
+        });
+        return partials;
+    }
+
+    static unsigned workerCount(size_t count, unsigned threads) {
+        if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+        return static_cast<unsigned>(std::min<size_t>(threads, count));
+    }
+
+    // Run work(t, begin, end) on each thread's range, rethrowing the first
+    // failure once every thread has joined
+    static void partitionResamples(size_t count, unsigned threads,
+                                   const std::function<void(unsigned, size_t, size_t)>& work) {
+        threads = workerCount(count, threads);
+        std::vector<std::exception_ptr> errors(threads);
+        std::vector<std::thread> workers;
+
+        auto run = [&](unsigned t) {
+            try {
+                work(t, count * t / threads, count * (t + 1) / threads);
+            } catch (...) {
+                errors[t] = std::current_exception();
+            }
+        };
+
+        for (unsigned t = 1; t < threads; t++) workers.emplace_back(run, t);
+        run(0);
+        for (auto& worker : workers) worker.join();
+        for (auto& error : errors) {
+            if (error) std::rethrow_exception(error);
+        }
+    }
+};
+
+int main() {
+    std::cout << std::string(60, '=') << std::endl;
+    std::cout << "STATISTICS CALCULATOR - C++" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+    std::cout << std::fixed << std::setprecision(4);
+
+    // Example 1: Simple linear regression
+    std::cout << "\n1. LINEAR REGRESSION" << std::endl;
+    std::cout << std::string(60, '-') << std::endl;
+    std::vector<double> x = {1, 2, 3, 4, 5};
+    std::vector<double> y = {2, 4, 5, 4, 5};
+    auto line = RegressionEngine::linearRegression(x, y);
+    std::cout << "X: [1, 2, 3, 4, 5]" << std::endl;
+    std::cout << "Y: [2, 4, 5, 4, 5]" << std::endl;
+    std::cout << "Regression line: y = " << line.first << "x + " << line.second << std::endl;
+    std::cout << "Analytical: y = 0.6x + 2.2 ✓" << std::endl;
+
+    // Example 2: Multivariate regression streamed across threads
+    std::cout << "\n2. MULTIVARIATE REGRESSION (streamed, multi-threaded)" << std::endl;
+    std::cout << std::string(60, '-') << std::endl;
+    const size_t rows = 200000;
+    const size_t features = 6;
+    const std::vector<double> trueBeta = {1.5, 2.0, -1.0, 0.5, 3.0, -2.5, 0.25};
+
+    // Rows are generated on demand from their index, never stored
+    auto source = [&](size_t i, double* xi, double& yi, double& weight) {
+        std::mt19937_64 rng(i);
+        std::normal_distribution<double> normal(0.0, 1.0);
+        yi = trueBeta[0];
+        for (size_t j = 0; j < features; j++) {
+            xi[j] = normal(rng);
+            yi += trueBeta[j + 1] * xi[j];
+        }
+        yi += 0.1 * normal(rng);
+        weight = 1.0;
+    };
+
+    RegressionResult fit = RegressionEngine::fit(rows, features, source);
+    std::cout << "Rows: " << fit.observations << ", features: " << features << std::endl;
+    std::cout << "Coefficient   fitted     true" << std::endl;
+    for (size_t j = 0; j < fit.coefficients.size(); j++) {
+        std::string name = (j == 0) ? "intercept" : "β" + std::to_string(j);
+        std::cout << std::left << std::setw(12) << name << std::right
+                  << std::setw(9) << fit.coefficients[j]
+                  << std::setw(9) << trueBeta[j] << std::endl;
+    }
+    std::cout << "R² = " << fit.rSquared << ", adjusted R² = " << fit.adjustedRSquared << std::endl;
+    std::cout << "Residual std. error = " << fit.residualStdError
+              << " on " << fit.degreesOfFreedom << " degrees of freedom (noise σ = 0.1) ✓" << std::endl;
+
+    // Example 3: Weighted and ridge variants
+    std::cout << "\n3. WEIGHTED AND RIDGE REGRESSION" << std::endl;
+    std::cout << std::string(60, '-') << std::endl;
+    std::vector<double> wx = {1, 2, 3, 4, 5, 6};
+    std::vector<double> wy = {1.1, 1.9, 3.2, 3.9, 5.1, 12.0};
+    std::vector<double> weights = {1, 1, 1, 1, 1, 0.01};
+    RegressionAccumulator plain(1), weighted(1);
+    for (size_t i = 0; i < wx.size(); i++) {
+        plain.addRow(&wx[i], wy[i]);
+        weighted.addRow(&wx[i], wy[i], weights[i]);
+    }
+    RegressionResult ols = plain.solve();
+    RegressionResult wls = weighted.solve();
+    std::cout << "Outlier at x = 6 (weight 0.01)" << std::endl;
+    std::cout << "Unweighted: y = " << ols.coefficients[1] << "x + " << ols.coefficients[0]
+              << ", R² = " << ols.rSquared << std::endl;
+    std::cout << "Weighted:   y = " << wls.coefficients[1] << "x + " << wls.coefficients[0]
+              << ", R² = " << wls.rSquared << std::endl;
+
+    for (double lambda : {0.0, 10.0, 1000.0}) {
+        RegressionResult ridge = plain.solve(lambda);
+        std::cout << "Ridge λ = " << std::setw(7) << lambda << ": slope = " << ridge.coefficients[1]
+                  << ", RSS = " << ridge.residualSumSquares << std::endl;
+    }
+    std::cout << "Larger λ shrinks the slope toward 0 ✓" << std::endl;
+
+    // Exactly collinear features: x₂ = 2·x₁ has no unique least-squares fit
+    RegressionAccumulator collinear(2);
+    for (size_t i = 0; i < wx.size(); i++) {
+        double row[2] = {wx[i], 2.0 * wx[i]};
+        collinear.addRow(row, wy[i]);
+    }
+    std::cout << "\nCollinear features (x₂ = 2·x₁):" << std::endl;
+    try {
+        collinear.solve();
+        std::cout << "OLS: unexpectedly solved" << std::endl;
+    } catch (const std::runtime_error& e) {
+        std::cout << "OLS: " << e.what() << " ✓" << std::endl;
+    }
+    RegressionResult penalised = collinear.solve(1.0);
+    std::cout << "Ridge λ = 1: β₁ = " << penalised.coefficients[1]
+              << ", β₂ = " << penalised.coefficients[2] << std::endl;
+
+    // Example 4: Bootstrap confidence intervals
+    std::cout << "\n4. BOOTSTRAP CONFIDENCE INTERVALS" << std::endl;
+    std::cout << std::string(60, '-') << std::endl;
+    std::vector<double> data = {12, 15, 18, 20, 22, 25, 28, 30, 15, 18};
+    std::cout << "Data: [12, 15, 18, 20, 22, 25, 28, 30, 15, 18]" << std::endl;
+    std::cout << "Mean: " << StatisticsCalculator::mean(data)
+              << ", sample std dev: " << StatisticsCalculator::stdDev(data) << std::endl;
+
+    auto printInterval = [](const std::string& name, const BootstrapResult& b) {
+        std::cout << std::left << std::setw(12) << name << std::right << std::setw(9) << b.estimate
+                  << "  95% CI [" << b.lower << ", " << b.upper << "]"
+                  << "  SE " << b.standardError << std::endl;
+    };
+    printInterval("Mean", ResamplingEngine::bootstrap(
+        data.size(), ResamplingEngine::meanStatistic(data), 10000));
+    printInterval("Std dev", ResamplingEngine::bootstrap(
+        data.size(), ResamplingEngine::stdDevStatistic(data), 10000));
+    printInterval("Correlation", ResamplingEngine::bootstrap(
+        x.size(), ResamplingEngine::correlationStatistic(x, y), 10000));
+
+    // Same seed, different thread counts: identical intervals
+    std::vector<double> large(100000);
+    std::mt19937_64 rng(42);
+    std::normal_distribution<double> normal(50.0, 8.0);
+    for (double& value : large) value = normal(rng);
+    BootstrapResult single = ResamplingEngine::bootstrap(
+        large.size(), ResamplingEngine::meanStatistic(large), 500, 0.95, 7, 1);
+    BootstrapResult parallel = ResamplingEngine::bootstrap(
+        large.size(), ResamplingEngine::meanStatistic(large), 500, 0.95, 7);
+    std::cout << "\n100000 draws from N(50, 8²), 500 resamples:" << std::endl;
+    printInterval("1 thread", single);
+    printInterval("All threads", parallel);
+    std::cout << "Analytical SE: 8/√100000 = " << 8.0 / std::sqrt(100000.0) << std::endl;
+    std::cout << "Identical across thread counts: "
+              << ((single.lower == parallel.lower && single.upper == parallel.upper) ? "yes ✓" : "no")
+              << std::endl;
+
+    // Example 5: Permutation tests
+    std::cout << "\n5. PERMUTATION TESTS" << std::endl;
+    std::cout << std::string(60, '-') << std::endl;
+    PermutationResult corrTest = ResamplingEngine::permutationTest(
+        x.size(), ResamplingEngine::permutedCorrelationStatistic(x, y));
+    std::cout << "Correlation of X and Y: r = " << corrTest.observed
+              << ", p = " << corrTest.pValue << std::endl;
+    std::cout << "Interpretation: correlation is "
+              << ((corrTest.pValue < 0.05) ? "significant" : "not significant (only 5 pairs)")
+              << " at the 0.05 level" << std::endl;
+
+    std::vector<double> groupA = {12, 15, 18, 20, 22};
+    std::vector<double> groupB = {25, 28, 30, 27, 24};
+    std::vector<double> pooled(groupA);
+    pooled.insert(pooled.end(), groupB.begin(), groupB.end());
+    PermutationResult meanTest = ResamplingEngine::permutationTest(
+        pooled.size(), ResamplingEngine::meanDifferenceStatistic(pooled, groupA.size()));
+    std::cout << "\nGroup A: [12, 15, 18, 20, 22], Group B: [25, 28, 30, 27, 24]" << std::endl;
+    std::cout << "Difference in means: " << meanTest.observed
+              << ", p = " << meanTest.pValue << std::endl;
+    std::string verdict = (meanTest.pValue < 0.05) ? "significant" : "not significant";
+    std::cout << "Interpretation: difference is " << verdict << " at the 0.05 level" << std::endl;
+
+    std::cout << "\n" << std::string(60, '=') << std::endl;
+
+    return 0;
+}
@@ -82,6 +82,15 @@ if command -v g++ &> /dev/null; then
         ((FAILED++))
     fi
     
+    # Compile and run statistics
+    if g++ -std=c++17 -O2 -pthread statistics_calculator.cpp -o statistics_calc 2>/dev/null; then
+        run_test "C++ Statistics Calculator" "./statistics_calc"
+        rm -f statistics_calc
+    else
+        echo -e "${RED}Failed to compile C++ Statistics Calculator${NC}"
+        ((FAILED++))
+    fi
+    
     cd ..
 else
     echo -e "${RED}g++ not found, skipping C++ tests${NC}"